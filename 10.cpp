@@ -0,0 +1,276 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <mpi.h>
+#include <omp.h>
+
+// Гибридный режим MPI+OpenMP для скалярного произведения (2.cpp) и интегрирования (3.cpp).
+// Диапазон индексов делится между процессами MPI, внутри процесса работает OpenMP,
+// частичные результаты объединяются через MPI_Allreduce.
+//
+// Сборка:  mpicxx -std=c++17 -O2 -fopenmp 10.cpp -o 10
+// Запуск:  OMP_NUM_THREADS=<ядра/процессы> mpirun -np 4 --bind-to none ./10 [N] [vec1.bin vec2.bin]
+//          (или --map-by socket:PE=<ядра/процессы>, чтобы каждому процессу достались свои ядра)
+// Файлы vec1.bin/vec2.bin содержат подряд идущие 32-битные int; каждый процесс читает только свой диапазон.
+
+// Границы локального блока [begin, end) процесса rank из size для n элементов
+void local_range(long long n, int rank, int size, long long &begin, long long &end) {
+    long long chunk = n / size;
+    long long rest = n % size;
+    begin = rank * chunk + std::min<long long>(rank, rest);
+    end = begin + chunk + (rank < rest ? 1 : 0);
+}
+
+// Значение элемента зависит только от глобального индекса, поэтому результат
+// не зависит от числа процессов (случайные числа от 0 до 99, как в 2.cpp)
+int element_value(unsigned long long seed, long long index) {
+    unsigned long long z = seed + static_cast<unsigned long long>(index) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z = z ^ (z >> 31);
+    return static_cast<int>(z % 100);
+}
+
+// Генерация локального блока вектора
+std::vector<int> generateLocalVector(unsigned long long seed, long long begin, long long end) {
+    std::vector<int> vec(end - begin);
+
+    #pragma omp parallel for
+    for (long long i = begin; i < end; ++i) {
+        vec[i - begin] = element_value(seed, i);
+    }
+    return vec;
+}
+
+// Количество int в бинарном файле
+long long file_length(const std::string &path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        return -1;
+    }
+    return static_cast<long long>(in.tellg()) / static_cast<long long>(sizeof(int32_t));
+}
+
+// Загрузка локального блока [begin, end) из бинарного файла
+std::vector<int> loadLocalVector(const std::string &path, long long begin, long long end) {
+    std::vector<int32_t> raw(end - begin);
+    std::ifstream in(path, std::ios::binary);
+    in.seekg(begin * static_cast<long long>(sizeof(int32_t)));
+    in.read(reinterpret_cast<char *>(raw.data()), raw.size() * sizeof(int32_t));
+    if (!in) {
+        std::cerr << "Error: cannot read range [" << begin << ", " << end << ") from " << path << "\n";
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+    return std::vector<int>(raw.begin(), raw.end());
+}
+
+// Параллельное скалярное произведение локального блока (ядро из 2.cpp)
+long long dotProductParallel(const std::vector<int> &vec1, const std::vector<int> &vec2) {
+    long long result = 0;
+
+    #pragma omp parallel for reduction(+:result)
+    for (size_t i = 0; i < vec1.size(); ++i) {
+        result += static_cast<long long>(vec1[i]) * vec2[i];
+    }
+
+    return result;
+}
+
+// Гибридное скалярное произведение: OpenMP внутри процесса + MPI_Allreduce
+long long dotProductHybrid(const std::vector<int> &vec1, const std::vector<int> &vec2, MPI_Comm comm) {
+    long long local = dotProductParallel(vec1, vec2);
+    long long result = 0;
+    MPI_Allreduce(&local, &result, 1, MPI_LONG_LONG, MPI_SUM, comm);
+    return result;
+}
+
+// Функция для интегрирования
+double f(double x) {
+    return x*x*x;
+}
+
+// Метод прямоугольников на шагах [begin, end) из n (ядро из 3.cpp)
+double parallel_integral(double a, double b, long long n, long long begin, long long end) {
+    double h = (b - a) / n;
+    double integral = 0.0;
+
+    #pragma omp parallel for reduction(+:integral)
+    for (long long i = begin; i < end; ++i) {
+        double x = a + i * h;
+        integral += f(x) * h;
+    }
+
+    return integral;
+}
+
+// Гибридное интегрирование: шаги делятся между процессами коммуникатора comm
+double hybrid_integral(double a, double b, long long n, MPI_Comm comm) {
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    long long begin, end;
+    local_range(n, rank, size, begin, end);
+
+    double local = parallel_integral(a, b, n, begin, end);
+    double result = 0.0;
+    MPI_Allreduce(&local, &result, 1, MPI_DOUBLE, MPI_SUM, comm);
+    return result;
+}
+
+// Максимальное по процессам время: медленнейший процесс определяет время всего шага
+double max_time(double local, MPI_Comm comm) {
+    double result = 0.0;
+    MPI_Allreduce(&local, &result, 1, MPI_DOUBLE, MPI_MAX, comm);
+    return result;
+}
+
+struct Measurement {
+    long long value = 0;
+    double integral = 0.0;
+    double dot_time = 0.0;
+    double integral_time = 0.0;
+};
+
+// Один замер на коммуникаторе comm: n элементов вектора и steps шагов интегрирования
+Measurement measure(MPI_Comm comm, long long n, long long steps, unsigned long long seed,
+                    const std::vector<std::string> &files) {
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    long long begin, end;
+    local_range(n, rank, size, begin, end);
+
+    // Данные готовятся локально и в замер не входят
+    std::vector<int> vec1, vec2;
+    if (files.empty()) {
+        vec1 = generateLocalVector(seed, begin, end);
+        vec2 = generateLocalVector(seed + 1, begin, end);
+    } else {
+        vec1 = loadLocalVector(files[0], begin, end);
+        vec2 = loadLocalVector(files[1], begin, end);
+    }
+
+    Measurement m;
+
+    MPI_Barrier(comm);
+    double start = MPI_Wtime();
+    m.value = dotProductHybrid(vec1, vec2, comm);
+    m.dot_time = max_time(MPI_Wtime() - start, comm);
+
+    const double a = 0.0;
+    const double b = 1000000;
+    MPI_Barrier(comm);
+    start = MPI_Wtime();
+    m.integral = hybrid_integral(a, b, steps, comm);
+    m.integral_time = max_time(MPI_Wtime() - start, comm);
+
+    return m;
+}
+
+int main(int argc, char **argv) {
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    // MPI вызывается только из главного потока, но внутри процесса работают потоки OpenMP
+    if (provided < MPI_THREAD_FUNNELED) {
+        if (rank == 0) {
+            std::cerr << "Error: MPI library does not support MPI_THREAD_FUNNELED\n";
+        }
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    if (argc == 3 || argc > 4) {
+        if (rank == 0) {
+            std::cerr << "Usage: " << argv[0] << " [N] [vec1.bin vec2.bin]\n";
+        }
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    // Размер задачи для сильного масштабирования (для слабого это размер при максимальном числе процессов)
+    long long vectorSize = 40000000;
+    long long steps = 100000000;
+    std::vector<std::string> files;
+
+    if (argc > 1) {
+        vectorSize = std::atoll(argv[1]);
+        steps = vectorSize;
+    }
+    if (argc == 4) {
+        files = {argv[2], argv[3]};
+        long long len = std::min(file_length(files[0]), file_length(files[1]));
+        if (len <= 0) {
+            if (rank == 0) {
+                std::cerr << "Error: cannot open " << files[0] << " or " << files[1] << "\n";
+            }
+            MPI_Abort(MPI_COMM_WORLD, 1);
+        }
+        vectorSize = std::min(vectorSize, len);
+    }
+
+    // Общее зерно генератора, чтобы все процессы строили один и тот же глобальный вектор
+    unsigned long long seed = static_cast<unsigned long long>(time(0));
+    MPI_Bcast(&seed, 1, MPI_UNSIGNED_LONG_LONG, 0, MPI_COMM_WORLD);
+
+    if (rank == 0) {
+        std::cout << "MPI processes: " << size << ", OpenMP threads per process: " << omp_get_max_threads() << '\n';
+        std::cout << "Vector size: " << vectorSize << ", integration steps: " << steps << '\n';
+        std::cout << "Data source: " << (files.empty() ? "rank-local generation" : "file ranges") << '\n';
+    }
+
+    // Число процессов для замеров: 1, 2, 4, ... и size
+    std::vector<int> counts;
+    for (int p = 1; p < size; p *= 2) {
+        counts.push_back(p);
+    }
+    counts.push_back(size);
+
+    const char *modes[] = {"strong", "weak"};
+    for (int mode = 0; mode < 2; ++mode) {
+        if (rank == 0) {
+            std::cout << "----- " << modes[mode] << " scaling -----\n";
+        }
+
+        double base_dot = 0.0, base_integral = 0.0;
+        for (int p : counts) {
+            // Подкоммуникатор из первых p процессов
+            MPI_Comm sub;
+            MPI_Comm_split(MPI_COMM_WORLD, rank < p ? 0 : MPI_UNDEFINED, rank, &sub);
+
+            if (sub != MPI_COMM_NULL) {
+                long long n = mode == 0 ? vectorSize : vectorSize / size * p;
+                long long s = mode == 0 ? steps : steps / size * p;
+                Measurement m = measure(sub, n, s, seed, files);
+
+                if (rank == 0) {
+                    if (p == 1) {
+                        base_dot = m.dot_time;
+                        base_integral = m.integral_time;
+                    }
+                    // Для сильного масштабирования эффективность = T1 / (p * Tp), для слабого = T1 / Tp
+                    double scale = mode == 0 ? p : 1;
+                    std::cout << "processes: " << p << ", size: " << n << '\n';
+                    std::cout << "  Dot product: " << m.value << ", time: " << m.dot_time
+                              << " s, efficiency: " << base_dot / (scale * m.dot_time) << '\n';
+                    std::cout << "  Integral: " << m.integral << ", time: " << m.integral_time
+                              << " s, efficiency: " << base_integral / (scale * m.integral_time) << '\n';
+                }
+                MPI_Comm_free(&sub);
+            }
+            MPI_Barrier(MPI_COMM_WORLD);
+        }
+    }
+
+    MPI_Finalize();
+    return 0;
+}
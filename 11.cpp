@@ -0,0 +1,244 @@
+#include <iostream>
+#include <vector>
+#include <variant>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <omp.h>
+
+// Компактное хранение целых чисел: значения из 2.cpp, 4.cpp, 5.cpp и 9.cpp лежат в 0..99 (1..100),
+// поэтому вместо 4-байтного int достаточно int8_t. Все ядра ниже упираются в пропускную способность памяти,
+// так что уменьшение числа байт на элемент напрямую ускоряет их. Расширение до int происходит только в регистрах.
+
+// Вектор в самом узком типе, вмещающем диапазон значений
+using PackedVector = std::variant<std::vector<int8_t>, std::vector<int16_t>, std::vector<int32_t>>;
+
+// Размер блока для накопления скалярного произведения в int32:
+// |a*b| <= 2^14 для int8, и 2^16 таких произведений не переполняют int32 (2^30 < 2^31)
+const size_t DOT_BLOCK = 1 << 16;
+
+template <typename T>
+std::vector<T> narrow(const std::vector<int> &vec) {
+    std::vector<T> packed(vec.size());
+
+    #pragma omp parallel for
+    for (size_t i = 0; i < vec.size(); ++i) {
+        packed[i] = static_cast<T>(vec[i]);
+    }
+    return packed;
+}
+
+// Упаковка: выбор int8/int16/int32 по минимуму и максимуму значений
+PackedVector pack(const std::vector<int> &vec) {
+    int min_val = std::numeric_limits<int>::max();
+    int max_val = std::numeric_limits<int>::min();
+
+    #pragma omp parallel for reduction(min:min_val) reduction(max:max_val)
+    for (size_t i = 0; i < vec.size(); ++i) {
+        min_val = vec[i] < min_val ? vec[i] : min_val;
+        max_val = vec[i] > max_val ? vec[i] : max_val;
+    }
+
+    if (min_val >= std::numeric_limits<int8_t>::min() && max_val <= std::numeric_limits<int8_t>::max()) {
+        return narrow<int8_t>(vec);
+    }
+    if (min_val >= std::numeric_limits<int16_t>::min() && max_val <= std::numeric_limits<int16_t>::max()) {
+        return narrow<int16_t>(vec);
+    }
+    return narrow<int32_t>(vec);
+}
+
+size_t packed_bytes(const PackedVector &vec) {
+    return std::visit([](const auto &v) { return v.size() * sizeof(v[0]); }, vec);
+}
+
+const char *packed_type(const PackedVector &vec) {
+    const char *names[] = {"int8", "int16", "int32"};
+    return names[vec.index()];
+}
+
+// Минимум и максимум (1.cpp) на упакованных данных
+template <typename T>
+std::pair<int, int> find_min_max_packed(const std::vector<T> &vec) {
+    T min_val = std::numeric_limits<T>::max();
+    T max_val = std::numeric_limits<T>::min();
+    const T *data = vec.data();
+    size_t n = vec.size();
+
+    #pragma omp parallel for reduction(min:min_val) reduction(max:max_val)
+    for (size_t i = 0; i < n; ++i) {
+        min_val = data[i] < min_val ? data[i] : min_val;
+        max_val = data[i] > max_val ? data[i] : max_val;
+    }
+
+    return {min_val, max_val};
+}
+
+std::pair<int, int> find_min_max_packed(const PackedVector &vec) {
+    return std::visit([](const auto &v) { return find_min_max_packed(v); }, vec);
+}
+
+// Скалярное произведение (2.cpp) на упакованных данных
+template <typename T1, typename T2>
+long long dotProductPacked(const std::vector<T1> &vec1, const std::vector<T2> &vec2) {
+    long long result = 0;
+    const T1 *a = vec1.data();
+    const T2 *b = vec2.data();
+    size_t n = vec1.size();
+
+    if constexpr (sizeof(T1) == 1 && sizeof(T2) == 1) {
+        // Внутри блока сумма помещается в int32, что даёт вдвое больше элементов на векторный регистр
+        #pragma omp parallel for reduction(+:result)
+        for (size_t block = 0; block < n; block += DOT_BLOCK) {
+            size_t end = std::min(n, block + DOT_BLOCK);
+            int partial = 0;
+            for (size_t i = block; i < end; ++i) {
+                partial += a[i] * b[i];
+            }
+            result += partial;
+        }
+    } else {
+        #pragma omp parallel for reduction(+:result)
+        for (size_t i = 0; i < n; ++i) {
+            result += static_cast<long long>(a[i]) * b[i];
+        }
+    }
+
+    return result;
+}
+
+long long dotProductPacked(const PackedVector &vec1, const PackedVector &vec2) {
+    return std::visit([](const auto &v1, const auto &v2) { return dotProductPacked(v1, v2); }, vec1, vec2);
+}
+
+// Максимум среди минимумов строк (4.cpp, 5.cpp, 9.cpp) для упакованной матрицы rows x cols,
+// хранящейся по строкам в одном векторе
+template <typename T>
+int find_max_of_min_packed(const std::vector<T> &matrix, int rows, int cols) {
+    int max_min = std::numeric_limits<int>::min();
+
+    #pragma omp parallel for reduction(max:max_min)
+    for (int i = 0; i < rows; ++i) {
+        const T *row = matrix.data() + static_cast<size_t>(i) * cols;
+        T min_in_row = std::numeric_limits<T>::max();
+        for (int j = 0; j < cols; ++j) {
+            min_in_row = row[j] < min_in_row ? row[j] : min_in_row;
+        }
+        max_min = std::max<int>(max_min, min_in_row);
+    }
+
+    return max_min;
+}
+
+int find_max_of_min_packed(const PackedVector &matrix, int rows, int cols) {
+    return std::visit([rows, cols](const auto &m) { return find_max_of_min_packed(m, rows, cols); }, matrix);
+}
+
+// Исходные ядра на int для сравнения
+std::pair<int, int> find_min_max(const std::vector<int> &vec) {
+    int min_val = std::numeric_limits<int>::max();
+    int max_val = std::numeric_limits<int>::min();
+
+    #pragma omp parallel for reduction(min:min_val) reduction(max:max_val)
+    for (size_t i = 0; i < vec.size(); ++i) {
+        if (vec[i] < min_val) min_val = vec[i];
+        if (vec[i] > max_val) max_val = vec[i];
+    }
+
+    return {min_val, max_val};
+}
+
+long long dotProductParallel(const std::vector<int> &vec1, const std::vector<int> &vec2) {
+    long long result = 0;
+
+    #pragma omp parallel for reduction(+:result)
+    for (size_t i = 0; i < vec1.size(); ++i) {
+        result += static_cast<long long>(vec1[i]) * vec2[i];
+    }
+
+    return result;
+}
+
+int find_max_of_min_parallel(const std::vector<int> &matrix, int rows, int cols) {
+    int max_min = -1;
+
+    #pragma omp parallel for reduction(max:max_min)
+    for (int i = 0; i < rows; ++i) {
+        const int *row = matrix.data() + static_cast<size_t>(i) * cols;
+        int min_in_row = row[0];
+        for (int j = 1; j < cols; ++j) {
+            if (row[j] < min_in_row) {
+                min_in_row = row[j];
+            }
+        }
+        if (min_in_row > max_min) {
+            max_min = min_in_row;
+        }
+    }
+
+    return max_min;
+}
+
+// Случайный вектор со значениями от 0 до 99, как в 2.cpp
+std::vector<int> generateRandomVector(size_t size) {
+    std::vector<int> vec(size);
+    for (size_t i = 0; i < size; ++i) {
+        vec[i] = rand() % 100;
+    }
+    return vec;
+}
+
+int main() {
+    srand(static_cast<unsigned>(time(0)));
+
+    const size_t vectorSize = 50000000;
+    const int rows = 1000;
+    const int cols = 50000;
+
+    std::vector<int> vec1 = generateRandomVector(vectorSize);
+    std::vector<int> vec2 = generateRandomVector(vectorSize);
+    std::vector<int> matrix = generateRandomVector(static_cast<size_t>(rows) * cols);
+
+    PackedVector packed1 = pack(vec1);
+    PackedVector packed2 = pack(vec2);
+    PackedVector packedMatrix = pack(matrix);
+
+    std::cout << "Vector size: " << vectorSize << ", matrix: " << rows << " x " << cols << '\n';
+    std::cout << "Storage type: " << packed_type(packed1) << '\n';
+    std::cout << "Vector bytes: int = " << vec1.size() * sizeof(int)
+              << ", packed = " << packed_bytes(packed1) << '\n';
+
+    // Минимум и максимум
+    double start = omp_get_wtime();
+    auto [min_val, max_val] = find_min_max(vec1);
+    double intTime = omp_get_wtime() - start;
+    start = omp_get_wtime();
+    auto [min_packed, max_packed] = find_min_max_packed(packed1);
+    double packedTime = omp_get_wtime() - start;
+    std::cout << "Min/max (int): " << min_val << " / " << max_val << ", Time: " << intTime << " seconds\n";
+    std::cout << "Min/max (packed): " << min_packed << " / " << max_packed << ", Time: " << packedTime << " seconds\n";
+
+    // Скалярное произведение
+    start = omp_get_wtime();
+    long long dot = dotProductParallel(vec1, vec2);
+    intTime = omp_get_wtime() - start;
+    start = omp_get_wtime();
+    long long dotPacked = dotProductPacked(packed1, packed2);
+    packedTime = omp_get_wtime() - start;
+    std::cout << "Dot product (int): " << dot << ", Time: " << intTime << " seconds\n";
+    std::cout << "Dot product (packed): " << dotPacked << ", Time: " << packedTime << " seconds\n";
+
+    // Максимум среди минимумов
+    start = omp_get_wtime();
+    int maxMin = find_max_of_min_parallel(matrix, rows, cols);
+    intTime = omp_get_wtime() - start;
+    start = omp_get_wtime();
+    int maxMinPacked = find_max_of_min_packed(packedMatrix, rows, cols);
+    packedTime = omp_get_wtime() - start;
+    std::cout << "Max of mins (int): " << maxMin << ", Time: " << intTime << " seconds\n";
+    std::cout << "Max of mins (packed): " << maxMinPacked << ", Time: " << packedTime << " seconds\n";
+
+    return 0;
+}
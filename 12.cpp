@@ -0,0 +1,466 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+#include <omp.h>
+
+// Многомерное интегрирование методами Монте-Карло и квази-Монте-Карло.
+// В отличие от метода прямоугольников из 3.cpp, стоимость не растёт экспоненциально с размерностью:
+// погрешность MC убывает как 1/sqrt(N), QMC (Соболь, Холтон) — почти как 1/N.
+//
+// Сборка:  g++ -std=c++17 -O3 -march=native -ffast-math -fopenmp 12.cpp -o 12
+// (-ffast-math нужен, чтобы std::exp в цикле по точкам заменялся векторной версией из libmvec)
+
+enum class Method { MonteCarlo, Halton, Sobol };
+
+struct IntegrationResult {
+    double estimate;
+    double std_error;
+    double samples_per_second;
+    size_t samples;
+};
+
+// Число точек, которые генерируются и вычисляются за один раз
+const int BATCH = 256;
+
+// Количество, среднее и сумма квадратов отклонений от среднего. Частичные результаты объединяются
+// по формуле Чана, поэтому дисперсия не считается как разность близких E[f^2] и E[f]^2
+struct Moments {
+    double count = 0.0;
+    double mean = 0.0;
+    double m2 = 0.0;
+
+    void merge(const Moments &other) {
+        if (other.count == 0.0) {
+            return;
+        }
+        double total = count + other.count;
+        double delta = other.mean - mean;
+        mean += delta * other.count / total;
+        m2 += other.m2 + delta * delta * count * other.count / total;
+        count = total;
+    }
+};
+
+// Число независимых рандомизаций QMC для оценки стандартной ошибки
+const int QMC_REPLICAS = 16;
+
+// Направляющие числа Соболя (Joe, Kuo, new-joe-kuo-6.21201) для размерностей 2..21:
+// степень s примитивного многочлена, его коэффициенты a и начальные m_1..m_s
+struct SobolPolynomial {
+    int s;
+    unsigned a;
+    unsigned m[7];
+};
+
+const SobolPolynomial SOBOL_TABLE[] = {
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+    {7, 4, {1, 3, 7, 13, 13, 15, 69}},
+};
+
+const int MAX_SOBOL_DIM = 1 + sizeof(SOBOL_TABLE) / sizeof(SOBOL_TABLE[0]);
+
+const int PRIMES[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71,
+                      73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131};
+
+const int MAX_HALTON_DIM = sizeof(PRIMES) / sizeof(PRIMES[0]);
+
+// Направляющие числа v[k][j] для размерностей k = 0..dim-1 и битов j = 0..31
+std::vector<uint32_t> sobol_directions(int dim) {
+    std::vector<uint32_t> v(dim * 32);
+    for (int j = 0; j < 32; ++j) {
+        v[j] = 1u << (31 - j);
+    }
+    for (int k = 1; k < dim; ++k) {
+        const SobolPolynomial &p = SOBOL_TABLE[k - 1];
+        uint32_t *vk = v.data() + k * 32;
+        for (int j = 0; j < p.s; ++j) {
+            vk[j] = p.m[j] << (31 - j);
+        }
+        for (int j = p.s; j < 32; ++j) {
+            vk[j] = vk[j - p.s] ^ (vk[j - p.s] >> p.s);
+            for (int i = 1; i < p.s; ++i) {
+                if ((p.a >> (p.s - 1 - i)) & 1) {
+                    vk[j] ^= vk[j - i];
+                }
+            }
+        }
+    }
+    return v;
+}
+
+// Случайное линейное скремблирование Матоушека: направляющие числа каждой размерности умножаются слева
+// на случайную нижнетреугольную двоичную матрицу с единичной диагональю (цифры считаются от старшего бита)
+std::vector<uint32_t> scramble_directions(const std::vector<uint32_t> &directions, int dim, std::mt19937_64 &rng) {
+    std::vector<uint32_t> scrambled(directions.size());
+    for (int k = 0; k < dim; ++k) {
+        // rows[i] — i-я строка матрицы: единица на диагонали и случайные биты в более старших цифрах
+        uint32_t rows[32];
+        for (int i = 0; i < 32; ++i) {
+            uint32_t above = i == 0 ? 0 : ~0u << (32 - i);
+            rows[i] = (1u << (31 - i)) | (static_cast<uint32_t>(rng()) & above);
+        }
+        for (int j = 0; j < 32; ++j) {
+            uint32_t v = directions[k * 32 + j];
+            uint32_t result = 0;
+            for (int i = 0; i < 32; ++i) {
+                result |= static_cast<uint32_t>(__builtin_popcount(rows[i] & v) & 1) << (31 - i);
+            }
+            scrambled[k * 32 + j] = result;
+        }
+    }
+    return scrambled;
+}
+
+// Число цифр в системе счисления base, достаточное для 32-битной точности
+int halton_digits(int base) {
+    int digits = 0;
+    for (double scale = 1.0; scale < 0x1p32; scale *= base) {
+        ++digits;
+    }
+    return digits;
+}
+
+// Таблицы скремблированного Холтона: для размерности k, позиции цифры d и цифры c значение
+// table[offsets[k] + d * base + c] = perm_d(c) * base^-(d+1), где perm_d — случайная перестановка 0..base-1.
+// Незначащие нули тоже переставляются, поэтому учитываются все halton_digits(base) позиций
+std::vector<double> halton_tables(int dim, std::vector<size_t> &offsets, std::mt19937_64 &rng) {
+    std::vector<double> table;
+    std::vector<int> perm;
+    offsets.assign(dim, 0);
+    for (int k = 0; k < dim; ++k) {
+        int base = PRIMES[k];
+        offsets[k] = table.size();
+        double factor = 1.0 / base;
+        for (int d = 0; d < halton_digits(base); ++d) {
+            perm.resize(base);
+            for (int digit = 0; digit < base; ++digit) {
+                perm[digit] = digit;
+            }
+            std::shuffle(perm.begin(), perm.end(), rng);
+            for (int digit = 0; digit < base; ++digit) {
+                table.push_back(perm[digit] * factor);
+            }
+            factor /= base;
+        }
+    }
+    return table;
+}
+
+// Координата k точек first..first+count-1 скремблированного Холтона. Цифры номера первой точки
+// находятся делением, дальше номер увеличивается на единицу с переносом, и сумма вкладов цифр
+// обновляется только в изменившихся позициях, без делений
+void halton_coordinate(uint64_t first, int count, int base, int digits, const double *table,
+                       int *digit, double *coord) {
+    double value = 0.0;
+    for (int d = 0; d < digits; ++d) {
+        digit[d] = static_cast<int>(first % base);
+        first /= base;
+        value += table[d * base + digit[d]];
+    }
+
+    for (int b = 0; b < count; ++b) {
+        coord[b] = value;
+        for (int d = 0; d < digits; ++d) {
+            value -= table[d * base + digit[d]];
+            if (++digit[d] < base) {
+                value += table[d * base + digit[d]];
+                break;
+            }
+            digit[d] = 0;
+            value += table[d * base];
+        }
+    }
+}
+
+// Вычисление f во всех точках пакета и моменты полученных значений.
+// Пакет хранится по координатам: k-я координата точки b лежит в points[k * BATCH + b]
+template <typename F>
+Moments evaluate_batch(F &f, const double *points, int count, double *values) {
+    f(points, BATCH, count, values);
+
+    double sum = 0.0;
+    #pragma omp simd reduction(+:sum)
+    for (int b = 0; b < count; ++b) {
+        sum += values[b];
+    }
+
+    Moments batch;
+    batch.count = count;
+    batch.mean = sum / count;
+    double m2 = 0.0;
+    #pragma omp simd reduction(+:m2)
+    for (int b = 0; b < count; ++b) {
+        double delta = values[b] - batch.mean;
+        m2 += delta * delta;
+    }
+    batch.m2 = m2;
+    return batch;
+}
+
+// Отображение единичного куба на параллелепипед [lower, upper]
+void map_to_box(double *points, int count, const std::vector<double> &lower, const std::vector<double> &width) {
+    int dim = static_cast<int>(lower.size());
+    for (int k = 0; k < dim; ++k) {
+        double *coord = points + k * BATCH;
+        #pragma omp simd
+        for (int b = 0; b < count; ++b) {
+            coord[b] = lower[k] + width[k] * coord[b];
+        }
+    }
+}
+
+// Обычный Монте-Карло: у каждого потока свой независимый генератор
+template <typename F>
+Moments monte_carlo(F &f, const std::vector<double> &lower, const std::vector<double> &width,
+                    size_t samples, unsigned long long seed) {
+    int dim = static_cast<int>(lower.size());
+    size_t batches = (samples + BATCH - 1) / BATCH;
+    Moments total;
+
+    #pragma omp parallel
+    {
+        Moments local;
+        std::vector<double> values(BATCH);
+        std::seed_seq seq{seed, static_cast<unsigned long long>(omp_get_thread_num())};
+        std::mt19937_64 rng(seq);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        std::vector<double> points(BATCH * dim);
+
+        #pragma omp for schedule(static)
+        for (size_t batch = 0; batch < batches; ++batch) {
+            int count = static_cast<int>(std::min<size_t>(BATCH, samples - batch * BATCH));
+            for (int k = 0; k < dim; ++k) {
+                for (int b = 0; b < count; ++b) {
+                    points[k * BATCH + b] = dist(rng);
+                }
+            }
+            map_to_box(points.data(), count, lower, width);
+            local.merge(evaluate_batch(f, points.data(), count, values.data()));
+        }
+
+        #pragma omp critical
+        total.merge(local);
+    }
+
+    return total;
+}
+
+// Одна рандомизация квази-Монте-Карло: Холтон со случайными перестановками цифр
+// или Соболь со скремблированием Матоушека (случайная линейная матрица и цифровой сдвиг)
+template <typename F>
+double quasi_monte_carlo(F &f, Method method, const std::vector<double> &lower, const std::vector<double> &width,
+                         size_t samples, const std::vector<uint32_t> &directions, std::mt19937_64 &rng) {
+    int dim = static_cast<int>(lower.size());
+    size_t batches = (samples + BATCH - 1) / BATCH;
+
+    std::vector<uint32_t> scrambled;
+    std::vector<uint32_t> digital_shift(dim);
+    std::vector<double> tables;
+    std::vector<size_t> table_offsets;
+    std::vector<int> digits(dim);
+    if (method == Method::Halton) {
+        tables = halton_tables(dim, table_offsets, rng);
+        for (int k = 0; k < dim; ++k) {
+            digits[k] = halton_digits(PRIMES[k]);
+        }
+    } else {
+        scrambled = scramble_directions(directions, dim, rng);
+        for (int k = 0; k < dim; ++k) {
+            digital_shift[k] = static_cast<uint32_t>(rng());
+        }
+    }
+
+    double total = 0.0;
+
+    #pragma omp parallel reduction(+:total)
+    {
+        std::vector<double> values(BATCH);
+        std::vector<double> points(BATCH * dim);
+        std::vector<uint32_t> state(dim);
+        int digit[64];
+
+        #pragma omp for schedule(static)
+        for (size_t batch = 0; batch < batches; ++batch) {
+            size_t first = batch * BATCH;
+            int count = static_cast<int>(std::min<size_t>(BATCH, samples - first));
+
+            if (method == Method::Halton) {
+                for (int k = 0; k < dim; ++k) {
+                    halton_coordinate(first, count, PRIMES[k], digits[k], tables.data() + table_offsets[k],
+                                      digit, points.data() + k * BATCH);
+                }
+            } else {
+                // Первая точка пакета вычисляется напрямую по коду Грея номера, остальные — инкрементально
+                uint64_t gray = first ^ (first >> 1);
+                for (int k = 0; k < dim; ++k) {
+                    state[k] = 0;
+                    for (int j = 0; j < 32; ++j) {
+                        if ((gray >> j) & 1) {
+                            state[k] ^= scrambled[k * 32 + j];
+                        }
+                    }
+                }
+                for (int b = 0; b < count; ++b) {
+                    for (int k = 0; k < dim; ++k) {
+                        points[k * BATCH + b] = (state[k] ^ digital_shift[k]) * 0x1p-32;
+                    }
+                    int bit = __builtin_ctzll(~(first + b));
+                    for (int k = 0; k < dim; ++k) {
+                        state[k] ^= scrambled[k * 32 + bit];
+                    }
+                }
+            }
+
+            map_to_box(points.data(), count, lower, width);
+            Moments batch_moments = evaluate_batch(f, points.data(), count, values.data());
+            total += batch_moments.mean * batch_moments.count;
+        }
+    }
+
+    return total / samples;
+}
+
+// Интеграл f по параллелепипеду [lower, upper] по samples точкам.
+// f(x, stride, count, values) записывает в values[b] значение функции в точке b < count с координатами
+// x[b], x[stride + b], ..., x[(dim - 1) * stride + b]; внутренний цикл по точкам в f векторизуется
+template <typename F>
+IntegrationResult integrate(F f, const std::vector<double> &lower, const std::vector<double> &upper,
+                            size_t samples, Method method, unsigned long long seed = 0) {
+    int dim = static_cast<int>(lower.size());
+    if (dim < 1 || upper.size() != lower.size()) {
+        throw std::invalid_argument("lower and upper must have the same positive dimension");
+    }
+    if ((method == Method::Sobol && dim > MAX_SOBOL_DIM) || (method == Method::Halton && dim > MAX_HALTON_DIM)) {
+        throw std::invalid_argument("dimension " + std::to_string(dim) + " is not supported by this sequence");
+    }
+    // Стандартной ошибке нужны хотя бы две точки MC или по одной точке на каждую рандомизацию QMC
+    size_t min_samples = method == Method::MonteCarlo ? 2 : QMC_REPLICAS;
+    if (samples < min_samples) {
+        throw std::invalid_argument("at least " + std::to_string(min_samples) + " samples are required");
+    }
+
+    std::vector<double> width(dim);
+    double volume = 1.0;
+    for (int k = 0; k < dim; ++k) {
+        width[k] = upper[k] - lower[k];
+        volume *= width[k];
+    }
+
+    IntegrationResult result{};
+    double start = omp_get_wtime();
+
+    if (method == Method::MonteCarlo) {
+        Moments moments = monte_carlo(f, lower, width, samples, seed);
+        double variance = moments.m2 / (samples - 1);
+        result.estimate = volume * moments.mean;
+        result.std_error = volume * std::sqrt(variance / samples);
+        result.samples = samples;
+    } else {
+        // Ошибка QMC оценивается по разбросу независимых рандомизаций
+        std::vector<uint32_t> directions;
+        if (method == Method::Sobol) {
+            directions = sobol_directions(dim);
+        }
+        std::mt19937_64 rng(seed);
+        size_t per_replica = samples / QMC_REPLICAS;
+        std::vector<double> means(QMC_REPLICAS);
+        double mean = 0.0;
+        for (int r = 0; r < QMC_REPLICAS; ++r) {
+            means[r] = quasi_monte_carlo(f, method, lower, width, per_replica, directions, rng);
+            mean += means[r];
+        }
+        mean /= QMC_REPLICAS;
+        double variance = 0.0;
+        for (int r = 0; r < QMC_REPLICAS; ++r) {
+            variance += (means[r] - mean) * (means[r] - mean);
+        }
+        variance /= QMC_REPLICAS - 1;
+        result.estimate = volume * mean;
+        result.std_error = volume * std::sqrt(variance / QMC_REPLICAS);
+        result.samples = per_replica * QMC_REPLICAS;
+    }
+
+    result.samples_per_second = result.samples / (omp_get_wtime() - start);
+    return result;
+}
+
+int main() {
+    try {
+        const size_t samples = 1 << 22; // Количество точек
+        const Method methods[] = {Method::MonteCarlo, Method::Halton, Method::Sobol};
+        const char *names[] = {"Monte Carlo", "Halton (scrambled)", "Sobol (scrambled)"};
+
+        for (int dim : {6, 12, 20}) {
+            std::cout << "----- dimension " << dim << " -----\n";
+
+            // g-функция Соболя на [0, 1]^d, точное значение 1
+            auto g = [dim](const double *x, int stride, int count, double *values) {
+                std::fill(values, values + count, 1.0);
+                for (int k = 0; k < dim; ++k) {
+                    const double *xk = x + k * stride;
+                    #pragma omp simd
+                    for (int b = 0; b < count; ++b) {
+                        values[b] *= (std::fabs(4.0 * xk[b] - 2.0) + k) / (1.0 + k);
+                    }
+                }
+            };
+            std::vector<double> unit_lower(dim, 0.0), unit_upper(dim, 1.0);
+
+            // Гауссова функция на [-1, 1]^d, точное значение (sqrt(pi) * erf(1))^d
+            auto gauss = [dim](const double *x, int stride, int count, double *values) {
+                std::fill(values, values + count, 0.0);
+                for (int k = 0; k < dim; ++k) {
+                    const double *xk = x + k * stride;
+                    #pragma omp simd
+                    for (int b = 0; b < count; ++b) {
+                        values[b] += xk[b] * xk[b];
+                    }
+                }
+                #pragma omp simd
+                for (int b = 0; b < count; ++b) {
+                    values[b] = std::exp(-values[b]);
+                }
+            };
+            std::vector<double> box_lower(dim, -1.0), box_upper(dim, 1.0);
+            double gauss_exact = std::pow(std::sqrt(M_PI) * std::erf(1.0), dim);
+
+            for (int m = 0; m < 3; ++m) {
+                IntegrationResult r = integrate(g, unit_lower, unit_upper, samples, methods[m], 42);
+                std::cout << names[m] << ", g-function: estimate = " << r.estimate << " (exact 1)"
+                          << ", std error = " << r.std_error << ", samples/s = " << r.samples_per_second << '\n';
+
+                r = integrate(gauss, box_lower, box_upper, samples, methods[m], 42);
+                std::cout << names[m] << ", gaussian: estimate = " << r.estimate << " (exact " << gauss_exact << ")"
+                          << ", std error = " << r.std_error << ", samples/s = " << r.samples_per_second << '\n';
+            }
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
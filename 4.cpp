@@ -2,10 +2,12 @@
 #include <vector>
 #include <cstdlib>
 #include <ctime>
+#include <atomic>
 #include <omp.h>
 
 #define ROWS 100 // Размер матрицы (строки)
 #define COLS 10000 // Размер матрицы (столбцы)
+#define PRUNE_BLOCK 16 // Размер блока строки между проверками границы (одна кэш-линия)
 
 // Функция для инициализации матрицы случайными числами
 void initialize_matrix(std::vector<std::vector<int>> &matrix) {
@@ -55,6 +57,42 @@ int find_max_of_min_parallel(const std::vector<std::vector<int>> &matrix) {
     return max_min;
 }
 
+// Параллельный метод с отсечением строк, значения матрицы лежат в [min_value, max_value]
+int find_max_of_min_pruned(const std::vector<std::vector<int>> &matrix, int min_value, int max_value) {
+    std::atomic<int> bound(min_value - 1);
+
+    #pragma omp parallel
+    {
+        #pragma omp for
+        for (int i = 0; i < ROWS; ++i) {
+            if (bound.load(std::memory_order_relaxed) >= max_value) {
+                #pragma omp cancel for
+                continue;
+            }
+
+            const int *row = matrix[i].data();
+            int min_in_row = row[0];
+            bool dropped = false;
+            for (int j = 0; j < COLS && !dropped; j += PRUNE_BLOCK) {
+                int end = j + PRUNE_BLOCK < COLS ? j + PRUNE_BLOCK : COLS;
+                for (int k = j; k < end; ++k) {
+                    min_in_row = row[k] < min_in_row ? row[k] : min_in_row;
+                }
+                dropped = min_in_row <= bound.load(std::memory_order_relaxed);
+            }
+
+            if (!dropped) {
+                int current = bound.load(std::memory_order_relaxed);
+                while (min_in_row > current &&
+                       !bound.compare_exchange_weak(current, min_in_row, std::memory_order_relaxed)) {
+                }
+            }
+        }
+    }
+
+    return bound.load();
+}
+
 int main() {
     // Инициализация случайного генератора чисел
     srand(static_cast<unsigned>(time(0)));
@@ -77,6 +115,13 @@ int main() {
     std::cout << "Параллельный метод: Максимум среди минимумов = " << max_min_par
               << ", время выполнения = " << (end_time - start_time) << " секунд\n";
 
+    // Параллельное выполнение с отсечением
+    start_time = omp_get_wtime();
+    int max_min_pruned = find_max_of_min_pruned(matrix, 0, 99);
+    end_time = omp_get_wtime();
+    std::cout << "Метод с отсечением: Максимум среди минимумов = " << max_min_pruned
+              << ", время выполнения = " << (end_time - start_time) << " секунд\n";
+
     return 0;
 }
 
@@ -2,10 +2,12 @@
 #include <vector>
 #include <cstdlib>
 #include <ctime>
+#include <atomic>
 #include <omp.h>
 
 #define ROWS 10000 // Число строк матрицы
 #define BANDWIDTH 10 // Ширина ленты (ненулевые элементы)
+#define PRUNE_BLOCK 16 // Размер блока строки между проверками границы (одна кэш-линия)
 
 // Функция для инициализации ленточной матрицы
 std::vector<std::vector<int>> initialize_band_matrix() {
@@ -69,6 +71,42 @@ int find_max_of_min_parallel(const std::vector<std::vector<int>> &matrix) {
     return max_min;
 }
 
+// Параллельный метод с отсечением строк, значения матрицы лежат в [min_value, max_value]
+int find_max_of_min_pruned(const std::vector<std::vector<int>> &matrix, int min_value, int max_value) {
+    std::atomic<int> bound(min_value - 1);
+
+    #pragma omp parallel
+    {
+        #pragma omp for schedule(runtime)
+        for (int i = 0; i < ROWS; ++i) {
+            if (bound.load(std::memory_order_relaxed) >= max_value) {
+                #pragma omp cancel for
+                continue;
+            }
+
+            const int *row = matrix[i].data();
+            int min_in_row = row[0];
+            bool dropped = false;
+            for (int j = 0; j < ROWS && !dropped; j += PRUNE_BLOCK) {
+                int end = j + PRUNE_BLOCK < ROWS ? j + PRUNE_BLOCK : ROWS;
+                for (int k = j; k < end; ++k) {
+                    min_in_row = row[k] < min_in_row ? row[k] : min_in_row;
+                }
+                dropped = min_in_row <= bound.load(std::memory_order_relaxed);
+            }
+
+            if (!dropped) {
+                int current = bound.load(std::memory_order_relaxed);
+                while (min_in_row > current &&
+                       !bound.compare_exchange_weak(current, min_in_row, std::memory_order_relaxed)) {
+                }
+            }
+        }
+    }
+
+    return bound.load();
+}
+
 
 int main() {
     // Инициализация случайного генератора чисел
@@ -109,5 +147,15 @@ int main() {
         int max_min_triangular = find_max_of_min_parallel(triangular_matrix);
         end_time = omp_get_wtime();
         std::cout << "Параллельный метод (треугольная матрица): максимум среди минимумов = " << max_min_triangular << ", время выполнения = " << (end_time - start_time) << " секунд\n";
+
+        start_time = omp_get_wtime();
+        max_min_band = find_max_of_min_pruned(band_matrix, 0, 99);
+        end_time = omp_get_wtime();
+        std::cout << "Метод с отсечением (ленточная матрица): максимум среди минимумов = " << max_min_band << ", время выполнения = " << (end_time - start_time) << " секунд\n";
+
+        start_time = omp_get_wtime();
+        max_min_triangular = find_max_of_min_pruned(triangular_matrix, 0, 99);
+        end_time = omp_get_wtime();
+        std::cout << "Метод с отсечением (треугольная матрица): максимум среди минимумов = " << max_min_triangular << ", время выполнения = " << (end_time - start_time) << " секунд\n";
     }
 }
@@ -3,12 +3,168 @@
 #include <omp.h>
 #include <numeric>
 #include <chrono>
+#include <functional>
+#include <type_traits>
+#include <limits>
 
 // Инициализация большого массива
 void initialize_array(std::vector<int> &array, int value = 1) {
     std::fill(array.begin(), array.end(), value);
 }
 
+// Префиксная сумма одного блока, начиная со значения offset.
+// Для сложения цикл векторизуется через inscan-редукцию OpenMP, для остальных операций — обычный цикл
+template <bool Inclusive, typename T, typename Op>
+void scan_block(const T *in, T *out, size_t n, T offset, Op op) {
+    T running = offset;
+    if constexpr (std::is_same_v<Op, std::plus<T>> && Inclusive) {
+        #pragma omp simd reduction(inscan, +:running)
+        for (size_t i = 0; i < n; ++i) {
+            running += in[i];
+            #pragma omp scan inclusive(running)
+            out[i] = running;
+        }
+    } else if constexpr (std::is_same_v<Op, std::plus<T>>) {
+        #pragma omp simd reduction(inscan, +:running)
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = running;
+            #pragma omp scan exclusive(running)
+            running += in[i];
+        }
+    } else {
+        for (size_t i = 0; i < n; ++i) {
+            if constexpr (Inclusive) {
+                running = op(running, in[i]);
+                out[i] = running;
+            } else {
+                out[i] = running;
+                running = op(running, in[i]);
+            }
+        }
+    }
+}
+
+// Параллельная префиксная сумма в два прохода: каждый поток считает сумму своего блока,
+// затем один поток сканирует суммы блоков, после чего каждый поток сканирует свой блок со смещением
+template <bool Inclusive, typename T, typename Op>
+void scan_parallel(const std::vector<T> &in, std::vector<T> &out, Op op, T identity) {
+    size_t n = in.size();
+    out.resize(n);
+    std::vector<T> partials;
+
+    #pragma omp parallel
+    {
+        int num_threads = omp_get_num_threads();
+        int id = omp_get_thread_num();
+        size_t begin = n * id / num_threads;
+        size_t end = n * (id + 1) / num_threads;
+
+        #pragma omp single
+        partials.assign(num_threads + 1, identity);
+
+        // Проход 1: сумма своего блока (сумма последнего блока не нужна)
+        if (id + 1 < num_threads) {
+            T sum = identity;
+            for (size_t i = begin; i < end; ++i) {
+                sum = op(sum, in[i]);
+            }
+            partials[id + 1] = sum;
+        }
+
+        #pragma omp barrier
+
+        // Сканирование сумм блоков: partials[id] становится смещением блока id
+        #pragma omp single
+        for (int t = 1; t <= num_threads; ++t) {
+            partials[t] = op(partials[t - 1], partials[t]);
+        }
+
+        // Проход 2: сканирование своего блока со смещением
+        scan_block<Inclusive>(in.data() + begin, out.data() + begin, end - begin, partials[id], op);
+    }
+}
+
+// Для произвольной операции op нужен её нейтральный элемент identity (T() подходит только для сложения)
+template <typename T, typename Op>
+void inclusive_scan_parallel(const std::vector<T> &in, std::vector<T> &out, Op op, T identity) {
+    scan_parallel<true>(in, out, op, identity);
+}
+
+template <typename T>
+void inclusive_scan_parallel(const std::vector<T> &in, std::vector<T> &out) {
+    scan_parallel<true>(in, out, std::plus<T>(), T());
+}
+
+template <typename T, typename Op>
+void exclusive_scan_parallel(const std::vector<T> &in, std::vector<T> &out, Op op, T identity) {
+    scan_parallel<false>(in, out, op, identity);
+}
+
+template <typename T>
+void exclusive_scan_parallel(const std::vector<T> &in, std::vector<T> &out) {
+    scan_parallel<false>(in, out, std::plus<T>(), T());
+}
+
+// Сегментированная включающая префиксная сумма: flags[i] != 0 начинает новый сегмент с элемента i
+template <typename T, typename Op>
+void segmented_scan_parallel(const std::vector<T> &in, const std::vector<unsigned char> &flags,
+                             std::vector<T> &out, Op op, T identity) {
+    size_t n = in.size();
+    out.resize(n);
+    std::vector<T> partials;
+    std::vector<unsigned char> has_flag;
+
+    #pragma omp parallel
+    {
+        int num_threads = omp_get_num_threads();
+        int id = omp_get_thread_num();
+        size_t begin = n * id / num_threads;
+        size_t end = n * (id + 1) / num_threads;
+
+        #pragma omp single
+        {
+            partials.assign(num_threads + 1, identity);
+            has_flag.assign(num_threads + 1, 0);
+        }
+
+        // Проход 1: сумма хвоста блока после последнего начала сегмента
+        if (id + 1 < num_threads) {
+            T sum = identity;
+            unsigned char flagged = 0;
+            for (size_t i = begin; i < end; ++i) {
+                if (flags[i]) {
+                    sum = in[i];
+                    flagged = 1;
+                } else {
+                    sum = op(sum, in[i]);
+                }
+            }
+            partials[id + 1] = sum;
+            has_flag[id + 1] = flagged;
+        }
+
+        #pragma omp barrier
+
+        // Перенос между блоками обрывается на блоке, в котором начинается сегмент
+        #pragma omp single
+        for (int t = 1; t <= num_threads; ++t) {
+            partials[t] = has_flag[t] ? partials[t] : op(partials[t - 1], partials[t]);
+        }
+
+        // Проход 2
+        T running = partials[id];
+        for (size_t i = begin; i < end; ++i) {
+            running = flags[i] ? in[i] : op(running, in[i]);
+            out[i] = running;
+        }
+    }
+}
+
+template <typename T>
+void segmented_scan_parallel(const std::vector<T> &in, const std::vector<unsigned char> &flags, std::vector<T> &out) {
+    segmented_scan_parallel(in, flags, out, std::plus<T>(), T());
+}
+
 int main() {
     const size_t SIZE = 10000000; // Размер массива
     std::vector<int> array(SIZE);
@@ -89,6 +245,68 @@ int main() {
     std::cout << "Sum: " << sum << "\n";
     std::cout << "Time: " << std::chrono::duration<double>(end - start).count() << " s\n";
 
+    // Префиксные суммы
+    std::vector<int> expected(SIZE);
+    std::vector<int> scanned(SIZE);
+
+    std::cout << "std::inclusive_scan:\n";
+    start = std::chrono::high_resolution_clock::now();
+    std::inclusive_scan(array.begin(), array.end(), expected.begin());
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "Last: " << expected.back() << "\n";
+    std::cout << "Time: " << std::chrono::duration<double>(end - start).count() << " s\n";
+
+    std::cout << "Parallel Inclusive Scan:\n";
+    start = std::chrono::high_resolution_clock::now();
+    inclusive_scan_parallel(array, scanned);
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "Last: " << scanned.back() << ", matches: " << (scanned == expected ? "yes" : "no") << "\n";
+    std::cout << "Time: " << std::chrono::duration<double>(end - start).count() << " s\n";
+
+    std::cout << "std::exclusive_scan:\n";
+    start = std::chrono::high_resolution_clock::now();
+    std::exclusive_scan(array.begin(), array.end(), expected.begin(), 0);
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "Last: " << expected.back() << "\n";
+    std::cout << "Time: " << std::chrono::duration<double>(end - start).count() << " s\n";
+
+    std::cout << "Parallel Exclusive Scan:\n";
+    start = std::chrono::high_resolution_clock::now();
+    exclusive_scan_parallel(array, scanned);
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "Last: " << scanned.back() << ", matches: " << (scanned == expected ? "yes" : "no") << "\n";
+    std::cout << "Time: " << std::chrono::duration<double>(end - start).count() << " s\n";
+
+    // Сегменты по 1000 элементов: внутри каждого сегмента значения 1..1000
+    std::cout << "Parallel Segmented Scan:\n";
+    std::vector<unsigned char> flags(SIZE, 0);
+    for (size_t i = 0; i < SIZE; i += 1000) {
+        flags[i] = 1;
+    }
+    start = std::chrono::high_resolution_clock::now();
+    segmented_scan_parallel(array, flags, scanned);
+    end = std::chrono::high_resolution_clock::now();
+    bool segmented_ok = true;
+    for (size_t i = 0; i < SIZE; ++i) {
+        segmented_ok = segmented_ok && scanned[i] == static_cast<int>(i % 1000 + 1);
+    }
+    std::cout << "Last: " << scanned.back() << ", matches: " << (segmented_ok ? "yes" : "no") << "\n";
+    std::cout << "Time: " << std::chrono::duration<double>(end - start).count() << " s\n";
+
+    // Префиксный максимум по отрицательным значениям: проверка операции, отличной от сложения
+    std::cout << "Parallel Inclusive Max Scan:\n";
+    std::vector<int> negative(SIZE);
+    for (size_t i = 0; i < SIZE; ++i) {
+        negative[i] = -1000 + static_cast<int>((i * 7919) % 997);
+    }
+    auto max_op = [](int a, int b) { return a > b ? a : b; };
+    std::inclusive_scan(negative.begin(), negative.end(), expected.begin(), max_op);
+    start = std::chrono::high_resolution_clock::now();
+    inclusive_scan_parallel(negative, scanned, max_op, std::numeric_limits<int>::min());
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "Last: " << scanned.back() << ", matches: " << (scanned == expected ? "yes" : "no") << "\n";
+    std::cout << "Time: " << std::chrono::duration<double>(end - start).count() << " s\n";
+
     return 0;
 }
 
@@ -4,6 +4,8 @@
 #include <algorithm>
 #include <limits>
 #include <ctime>
+#include <utility>
+#include <atomic>
 
 // Функция для генерации случайной матрицы
 std::vector<std::vector<int>> generateMatrix(int rows, int cols, int minVal = 1, int maxVal = 100) {
@@ -55,6 +57,45 @@ int parallelMaxOfMins(const std::vector<std::vector<int>> &matrix, int rows, int
     return max_min;
 }
 
+// Размер блока строки между проверками границы (одна кэш-линия)
+const int PRUNE_BLOCK = 16;
+
+// Параллельный алгоритм с отсечением строк, значения матрицы лежат в [minVal, maxVal]
+int prunedMaxOfMins(const std::vector<std::vector<int>> &matrix, int rows, int cols, int minVal, int maxVal) {
+    std::atomic<int> bound(minVal - 1);
+
+    #pragma omp parallel
+    {
+        #pragma omp for
+        for (int i = 0; i < rows; ++i) {
+            if (bound.load(std::memory_order_relaxed) >= maxVal) {
+                #pragma omp cancel for
+                continue;
+            }
+
+            const int *row = matrix[i].data();
+            int min_in_row = row[0];
+            bool dropped = false;
+            for (int j = 0; j < cols && !dropped; j += PRUNE_BLOCK) {
+                int end = j + PRUNE_BLOCK < cols ? j + PRUNE_BLOCK : cols;
+                for (int k = j; k < end; ++k) {
+                    min_in_row = row[k] < min_in_row ? row[k] : min_in_row;
+                }
+                dropped = min_in_row <= bound.load(std::memory_order_relaxed);
+            }
+
+            if (!dropped) {
+                int current = bound.load(std::memory_order_relaxed);
+                while (min_in_row > current &&
+                       !bound.compare_exchange_weak(current, min_in_row, std::memory_order_relaxed)) {
+                }
+            }
+        }
+    }
+
+    return bound.load();
+}
+
 // Параллельный алгоритм с вложенным параллелизмом
 int nestedParallelMaxOfMins(const std::vector<std::vector<int>> &matrix) {
     int maxMin = std::numeric_limits<int>::min();
@@ -74,6 +115,55 @@ int nestedParallelMaxOfMins(const std::vector<std::vector<int>> &matrix) {
     return maxMin;
 }
 
+// Минимум строки из Cols элементов, полностью развёрнутый на этапе компиляции
+template <size_t... J>
+int unrolledRowMin(const int *row, std::index_sequence<J...>) {
+    int min_in_row = row[0];
+    ((min_in_row = std::min(min_in_row, row[J + 1])), ...);
+    return min_in_row;
+}
+
+// Алгоритм для фиксированного размера rows x cols, известного на этапе компиляции.
+// Без накладных расходов OpenMP: для маленьких матриц запуск потоков дороже самого счёта
+template <int Rows, int Cols>
+int fixedMaxOfMins(const std::vector<std::vector<int>> &matrix) {
+    static_assert(Rows > 0 && Cols > 0, "matrix shape must be positive");
+
+    int mins[Rows];
+    for (int i = 0; i < Rows; ++i) {
+        if constexpr (Cols == 1) {
+            mins[i] = matrix[i][0];
+        } else {
+            mins[i] = unrolledRowMin(matrix[i].data(), std::make_index_sequence<Cols - 1>{});
+        }
+    }
+
+    int max_min = mins[0];
+    for (int i = 1; i < Rows; ++i) {
+        max_min = std::max(max_min, mins[i]);
+    }
+    return max_min;
+}
+
+// Выбор специализированного алгоритма по размеру матрицы: параметры шаблона
+// задают пары (строки, столбцы) заранее скомпилированных размеров
+template <int Rows, int Cols, int... Shapes>
+int dispatchMaxOfMins(const std::vector<std::vector<int>> &matrix, int rows, int cols) {
+    if (rows == Rows && cols == Cols) {
+        return fixedMaxOfMins<Rows, Cols>(matrix);
+    }
+    if constexpr (sizeof...(Shapes) > 0) {
+        return dispatchMaxOfMins<Shapes...>(matrix, rows, cols);
+    } else {
+        return parallelMaxOfMins(matrix, rows, cols);
+    }
+}
+
+// Автоматический выбор: фиксированные размеры 4x4, 8x8, 10x10, 16x16, иначе общий параллельный алгоритм
+int autoMaxOfMins(const std::vector<std::vector<int>> &matrix, int rows, int cols) {
+    return dispatchMaxOfMins<4, 4, 8, 8, 10, 10, 16, 16>(matrix, rows, cols);
+}
+
 int main() {
     // Параметры матрицы
     const int rows = 10;
@@ -101,10 +191,22 @@ int main() {
     int nestedParResult = nestedParallelMaxOfMins(matrix);
     double nestedParTime = omp_get_wtime() - start;
 
+    // Алгоритм, специализированный под размер матрицы
+    start = omp_get_wtime();
+    int fixedResult = autoMaxOfMins(matrix, rows, cols);
+    double fixedTime = omp_get_wtime() - start;
+
+    // Параллельный алгоритм с отсечением
+    start = omp_get_wtime();
+    int prunedResult = prunedMaxOfMins(matrix, rows, cols, 1, 100);
+    double prunedTime = omp_get_wtime() - start;
+
     // Вывод результатов
     std::cout << "Sequential result: " << seqResult << ", Time: " << seqTime << " seconds" << std::endl;
     std::cout << "Parallel result (no nesting): " << parResult << ", Time: " << parTime << " seconds" << std::endl;
     std::cout << "Parallel result (with nesting): " << nestedParResult << ", Time: " << nestedParTime << " seconds" << std::endl;
+    std::cout << "Fixed-shape result: " << fixedResult << ", Time: " << fixedTime << " seconds" << std::endl;
+    std::cout << "Pruned result: " << prunedResult << ", Time: " << prunedTime << " seconds" << std::endl;
 
     return 0;
 }